@@ -13,6 +13,26 @@ struct Node {
     Node(const T& val) : value(val), next() {}
 };
 
+// Un Node<T> se guarda como el valor codificado seguido del ID del siguiente nodo
+template <typename T>
+struct MPointerCodec<Node<T>> {
+    static constexpr std::size_t size = MPointerCodec<T>::size + sizeof(int);
+
+    static void encode(const Node<T>& node, char* out) {
+        MPointerCodec<T>::encode(node.value, out);
+        int next_id = &node.next;
+        std::memcpy(out + MPointerCodec<T>::size, &next_id, sizeof(next_id));
+    }
+
+    static Node<T> decode(const char* in) {
+        Node<T> node(MPointerCodec<T>::decode(in));
+        int next_id;
+        std::memcpy(&next_id, in + MPointerCodec<T>::size, sizeof(next_id));
+        node.next = MPointer<Node<T>>(next_id);
+        return node;
+    }
+};
+
 template <typename T>
 class LinkedList {
 private:
@@ -1,7 +1,44 @@
 #include "mpointer.h"
+#include "linkedlist.h"
+#include <array>
 #include <iostream>
+#include <string>
 #include <windows.h> // Para Sleep
 
+// Struct plano: usa el codec por memcpy
+struct Punto {
+    double x;
+    double y;
+    int id;
+};
+
+// Tipo no trivialmente copiable con su propio codec
+struct Persona {
+    std::string nombre;
+    int edad;
+};
+
+template <>
+struct MPointerCodec<Persona> {
+    static constexpr std::size_t size = MPointerCodec<std::string>::size + MPointerCodec<int>::size;
+
+    static void encode(const Persona& persona, char* out) {
+        MPointerCodec<std::string>::encode(persona.nombre, out);
+        MPointerCodec<int>::encode(persona.edad, out + MPointerCodec<std::string>::size);
+    }
+
+    static Persona decode(const char* in) {
+        return Persona{MPointerCodec<std::string>::decode(in),
+                       MPointerCodec<int>::decode(in + MPointerCodec<std::string>::size)};
+    }
+};
+
+// Imprime el resultado de una comprobación y devuelve si fue correcta
+static bool check(bool ok, const std::string& descripcion) {
+    std::cout << (ok ? "CORRECTO: " : "ERROR: ") << descripcion << "\n";
+    return ok;
+}
+
 int main() {
     // Inicializa MPointer para conectarse al Memory Manager
     std::cout << "Inicializando el sistema de memoria...\n";
@@ -60,6 +97,71 @@ int main() {
         std::cout << "Esperando al Garbage Collector para liberar el bloque...\n";
         Sleep(6000); // Esperar 6 segundos para que el GC corra
 
+        bool ok = true;
+
+        // Prueba 5: Struct plano con el codec por memcpy
+        std::cout << "\nPrueba 5: Guardando un struct plano (Punto)\n";
+        MPointer<Punto> punto = MPointer<Punto>::New();
+        punto = Punto{1.5, -2.25, 7};
+        Punto p = *punto;
+        ok &= check(p.x == 1.5 && p.y == -2.25 && p.id == 7, "Punto{1.5, -2.25, 7} recuperado");
+
+        // Prueba 6: std::string, incluido el límite de longitud
+        std::cout << "\nPrueba 6: Guardando std::string\n";
+        MPointer<std::string> texto = MPointer<std::string>::New();
+        texto = std::string("hola\0mundo", 10);
+        ok &= check(*texto == std::string("hola\0mundo", 10), "string con '\\0' recuperado");
+        std::string largo(MPointerCodec<std::string>::max_length, 'x');
+        texto = largo;
+        ok &= check(*texto == largo, "string de " + std::to_string(largo.size()) + " bytes recuperado");
+        try {
+            texto = largo + "x";
+            ok &= check(false, "string demasiado largo aceptado");
+        } catch (const std::runtime_error& e) {
+            ok &= check(*texto == largo, std::string("string demasiado largo rechazado: ") + e.what());
+        }
+
+        // Prueba 7: Mensajes de más de 1 KB (std::array<std::string, 4>)
+        std::cout << "\nPrueba 7: Guardando un bloque de "
+                  << MPointerCodec<std::array<std::string, 4>>::size << " bytes\n";
+        MPointer<std::array<std::string, 4>> textos = MPointer<std::array<std::string, 4>>::New();
+        std::array<std::string, 4> valores = {"uno", "dos", largo, "cuatro"};
+        textos = valores;
+        ok &= check(*textos == valores, "std::array<std::string, 4> recuperado");
+
+        // Prueba 8: LinkedList<int> con el codec de Node<T>
+        std::cout << "\nPrueba 8: Usando LinkedList<int>\n";
+        LinkedList<int> lista;
+        lista.push(1);
+        lista.push(2);
+        lista.push(3);
+        lista.print();
+        int primero = lista.pop();
+        int segundo = lista.pop();
+        ok &= check(primero == 3 && segundo == 2, "pop devuelve 3 y luego 2");
+
+        // Prueba 9: Tipo propio con un MPointerCodec especializado
+        std::cout << "\nPrueba 9: Guardando un tipo con codec propio (Persona)\n";
+        MPointer<Persona> persona = MPointer<Persona>::New();
+        persona = Persona{"Ada", 36};
+        Persona leida = *persona;
+        ok &= check(leida.nombre == "Ada" && leida.edad == 36, "Persona{\"Ada\", 36} recuperada");
+
+        // Prueba 10: Un bloque que no cabe en un mensaje se rechaza al crearlo
+        std::cout << "\nPrueba 10: Creando un bloque de 64 MB\n";
+        try {
+            MPointer<std::array<char, 64 * 1024 * 1024>>::New();
+            ok &= check(false, "bloque de 64 MB aceptado");
+        } catch (const std::runtime_error& e) {
+            ok &= check(std::string(e.what()).find("Block too large") != std::string::npos,
+                        std::string("bloque de 64 MB rechazado: ") + e.what());
+        }
+
+        if (!ok) {
+            std::cerr << "\nAlgunas pruebas de codecs fallaron.\n";
+            return 1;
+        }
+
     } catch (const std::runtime_error& e) {
         std::cerr << "Error: " << e.what() << "\n";
         return 1;
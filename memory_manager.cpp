@@ -12,6 +12,7 @@
 #include <algorithm>     // Agregado para std::sort
 #include <winsock2.h>
 #include <ws2tcpip.h>
+#include "message_framing.h"
 
 #pragma comment(lib, "Ws2_32.lib") // Vincula la biblioteca Winsock
 
@@ -64,7 +65,7 @@ public:
     bool setValue(int id, const std::string& value) {
         std::lock_guard<std::mutex> lock(mutex_);
         auto it = blocks_.find(id);
-        if (it == blocks_.end() || it->second.is_free || value.size() > it->second.size) {
+        if (it == blocks_.end() || it->second.is_free || value.size() != it->second.size) {
             return false;
         }
         memcpy(memory_ + it->second.offset, value.data(), value.size());
@@ -72,13 +73,14 @@ public:
         return true;
     }
 
-    std::string getValue(int id) {
+    bool getValue(int id, std::string& value) {
         std::lock_guard<std::mutex> lock(mutex_);
         auto it = blocks_.find(id);
         if (it == blocks_.end() || it->second.is_free) {
-            return "";
+            return false;
         }
-        return std::string(memory_ + it->second.offset, it->second.size);
+        value.assign(memory_ + it->second.offset, it->second.size);
+        return true;
     }
 
     bool increaseRefCount(int id) {
@@ -192,16 +194,13 @@ private:
 
 // Función para manejar cada conexión de cliente
 void handleClient(SOCKET client_socket, MemoryManager& manager) {
-    char buffer[1024];
     while (true) {
-        memset(buffer, 0, sizeof(buffer));
-        int bytes_received = recv(client_socket, buffer, sizeof(buffer) - 1, 0);
-        if (bytes_received <= 0) {
+        std::string request; // Los valores de SET son binarios y pueden contener '\0'
+        if (!recvMessage(client_socket, request)) {
             closesocket(client_socket); // Usar closesocket en lugar de close
             return;
         }
 
-        std::string request(buffer);
         std::istringstream iss(request);
         std::string command;
         iss >> command;
@@ -211,21 +210,31 @@ void handleClient(SOCKET client_socket, MemoryManager& manager) {
             size_t size;
             std::string type;
             iss >> size >> type;
-            int id = manager.createBlock(size, type);
-            response = (id != -1) ? std::to_string(id) : "ERROR: No memory available";
+            if (size > kMaxBlockSize) {
+                // Un bloque así nunca cabría en un mensaje de SET/GET
+                response = "ERROR: Block too large (max " + std::to_string(kMaxBlockSize) + " bytes)";
+            } else {
+                int id = manager.createBlock(size, type);
+                response = (id != -1) ? std::to_string(id) : "ERROR: No memory available";
+            }
         } else if (command == "SET") {
             int id;
-            std::string value;
             iss >> id;
-            std::getline(iss, value);
-            value = value.substr(1); // Elimina el espacio inicial
-            bool success = manager.setValue(id, value);
-            response = success ? "OK" : "ERROR: Invalid ID or size";
+            // El valor son los bytes crudos que siguen al espacio tras el ID
+            std::streamoff pos = iss.tellg();
+            if (pos < 0 || static_cast<size_t>(pos) + 1 >= request.size()) {
+                response = "ERROR: Missing value";
+            } else {
+                std::string value = request.substr(static_cast<size_t>(pos) + 1);
+                bool success = manager.setValue(id, value);
+                response = success ? "OK" : "ERROR: Invalid ID or size";
+            }
         } else if (command == "GET") {
             int id;
             iss >> id;
-            std::string value = manager.getValue(id);
-            response = value.empty() ? "ERROR: Invalid ID" : value;
+            // La respuesta lleva el estado delante para no confundir datos con errores
+            std::string value;
+            response = manager.getValue(id, value) ? "OK " + value : "ERROR: Invalid ID";
         } else if (command == "INC_REF") {
             int id;
             iss >> id;
@@ -240,7 +249,10 @@ void handleClient(SOCKET client_socket, MemoryManager& manager) {
             response = "ERROR: Unknown command";
         }
 
-        send(client_socket, response.c_str(), static_cast<int>(response.size()), 0);
+        if (!sendMessage(client_socket, response)) {
+            closesocket(client_socket);
+            return;
+        }
     }
 }
 
@@ -0,0 +1,66 @@
+#ifndef MESSAGE_FRAMING_H
+#define MESSAGE_FRAMING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <winsock2.h>
+
+// Protocolo compartido entre MPointer y el Memory Manager: cada mensaje viaja
+// precedido por su longitud (4 bytes, orden de red), así los valores pueden
+// ser binarios y de cualquier tamaño hasta kMaxMessageSize
+
+// Tamaño máximo de un mensaje en cualquiera de los dos sentidos
+const uint32_t kMaxMessageSize = 64 * 1024 * 1024;
+
+// Espacio reservado para la cabecera de SET/GET ("SET <id> " u "OK "), así
+// cualquier bloque de hasta kMaxBlockSize bytes cabe en un mensaje
+const uint32_t kMaxBlockSize = kMaxMessageSize - 64;
+
+inline bool sendAll(SOCKET socket, const char* data, size_t size) {
+    while (size > 0) {
+        int sent = send(socket, data, static_cast<int>(size), 0);
+        if (sent == SOCKET_ERROR || sent == 0) {
+            return false;
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+inline bool recvAll(SOCKET socket, char* data, size_t size) {
+    while (size > 0) {
+        int received = recv(socket, data, static_cast<int>(size), 0);
+        if (received <= 0) {
+            return false;
+        }
+        data += received;
+        size -= static_cast<size_t>(received);
+    }
+    return true;
+}
+
+inline bool sendMessage(SOCKET socket, const std::string& message) {
+    if (message.size() > kMaxMessageSize) {
+        return false;
+    }
+    uint32_t length = htonl(static_cast<uint32_t>(message.size()));
+    return sendAll(socket, reinterpret_cast<const char*>(&length), sizeof(length)) &&
+           sendAll(socket, message.data(), message.size());
+}
+
+inline bool recvMessage(SOCKET socket, std::string& message) {
+    uint32_t length;
+    if (!recvAll(socket, reinterpret_cast<char*>(&length), sizeof(length))) {
+        return false;
+    }
+    length = ntohl(length);
+    if (length > kMaxMessageSize) {
+        return false;
+    }
+    message.resize(length);
+    return recvAll(socket, &message[0], message.size());
+}
+
+#endif // MESSAGE_FRAMING_H
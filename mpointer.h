@@ -1,7 +1,10 @@
 #ifndef MPOINTER_H
 #define MPOINTER_H
 
+#include "mpointer_codec.h"
+#include <stdexcept>
 #include <string>
+#include <typeinfo>
 
 class MPointerBase {
 protected:
@@ -30,4 +33,95 @@ public:
     int operator&() const;
 };
 
-#endif // MPOINTER_H
\ No newline at end of file
+// La implementación vive en el header para que MPointer<T> funcione con
+// cualquier T que tenga un MPointerCodec<T>, sin instanciaciones explícitas
+
+template <typename T>
+MPointer<T> MPointer<T>::New() {
+    MPointer<T> ptr;
+    size_t size = MPointerCodec<T>::size; // Reserva exactamente el tamaño codificado
+    std::string type = typeid(T).name();
+    std::string command = "CREATE " + std::to_string(size) + " " + type;
+    std::string response = sendCommand(command);
+
+    try {
+        ptr.id_ = std::stoi(response);
+    } catch (...) {
+        throw std::runtime_error("Failed to create memory block: " + response);
+    }
+    return ptr;
+}
+
+template <typename T>
+void MPointer<T>::set(T value) {
+    if (id_ == -1) {
+        throw std::runtime_error("Invalid MPointer: not initialized");
+    }
+    std::string command = "SET " + std::to_string(id_) + " ";
+    size_t header_size = command.size();
+    command.resize(header_size + MPointerCodec<T>::size);
+    MPointerCodec<T>::encode(value, &command[header_size]);
+
+    std::string response = sendCommand(command);
+    if (response != "OK") {
+        throw std::runtime_error("Failed to set value: " + response);
+    }
+}
+
+template <typename T>
+T MPointer<T>::get() const {
+    if (id_ == -1) {
+        throw std::runtime_error("Invalid MPointer: not initialized");
+    }
+    std::string command = "GET " + std::to_string(id_);
+    std::string response = sendCommand(command);
+    // Respuesta válida: "OK " seguido de los bytes del bloque
+    const std::string status = "OK ";
+    if (response.compare(0, status.size(), status) != 0) {
+        throw std::runtime_error(response);
+    }
+    if (response.size() - status.size() != MPointerCodec<T>::size) {
+        throw std::runtime_error("Unexpected block size for get: " +
+                                 std::to_string(response.size() - status.size()));
+    }
+    return MPointerCodec<T>::decode(response.data() + status.size());
+}
+
+template <typename T>
+T MPointer<T>::operator*() const {
+    return get();
+}
+
+template <typename T>
+MPointer<T>& MPointer<T>::operator=(const T& value) {
+    set(value);
+    return *this;
+}
+
+template <typename T>
+MPointer<T>& MPointer<T>::operator=(const MPointer<T>& other) {
+    if (id_ != other.id_) {
+        if (id_ != -1) {
+            sendCommand("DEC_REF " + std::to_string(id_));
+        }
+        id_ = other.id_;
+        if (id_ != -1) {
+            sendCommand("INC_REF " + std::to_string(id_));
+        }
+    }
+    return *this;
+}
+
+template <typename T>
+int MPointer<T>::operator&() const {
+    return id_;
+}
+
+template <typename T>
+MPointer<T>::~MPointer() {
+    if (id_ != -1) {
+        sendCommand("DEC_REF " + std::to_string(id_));
+    }
+}
+
+#endif // MPOINTER_H
@@ -0,0 +1,114 @@
+#ifndef MPOINTER_CODEC_H
+#define MPOINTER_CODEC_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Codec que traduce un T al bloque de bytes que guarda el Memory Manager.
+// Cada especializacion define:
+//   static constexpr std::size_t size;             // bytes exactos del bloque
+//   static void encode(const T& value, char* out); // escribe `size` bytes
+//   static T decode(const char* in);               // lee `size` bytes
+//
+// Para usar MPointer<T> con un tipo propio que no sea trivialmente copiable
+// basta con especializar MPointerCodec<T> siguiendo esa misma interfaz.
+template <typename T, typename Enable = void>
+struct MPointerCodec {
+    static_assert(sizeof(T) == 0,
+                  "MPointer<T> requires T to be a trivially copyable non-pointer type or to specialize MPointerCodec<T>");
+};
+
+// Tipos trivialmente copiables (int, double, structs planos...): se copian tal cual.
+// Los punteros quedan fuera (una dirección del cliente no tiene sentido en el
+// servidor), igual que los arreglos de C, que no se pueden devolver por valor
+template <typename T>
+struct is_mpointer_memcpy
+    : std::bool_constant<std::is_trivially_copyable_v<T> && !std::is_array_v<T> &&
+                         !std::is_pointer_v<T> && !std::is_member_pointer_v<T>> {};
+
+template <typename T, std::size_t N>
+struct is_mpointer_memcpy<std::array<T, N>> : is_mpointer_memcpy<T> {};
+
+template <typename T>
+inline constexpr bool is_mpointer_memcpy_v = is_mpointer_memcpy<T>::value;
+
+template <typename T>
+struct MPointerCodec<T, std::enable_if_t<is_mpointer_memcpy_v<T>>> {
+    static constexpr std::size_t size = sizeof(T);
+
+    static void encode(const T& value, char* out) {
+        std::memcpy(out, &value, size);
+    }
+
+    // Si T tiene constructor por defecto se copia sobre un objeto ya construido.
+    // Si no, los bytes se copian a un almacenamiento alineado y se leen como T;
+    // eso solo está bien definido desde C++20 (creación implícita de objetos
+    // para tipos trivialmente copiables)
+    static T decode(const char* in) {
+        if constexpr (std::is_default_constructible_v<T>) {
+            T value;
+            std::memcpy(&value, in, size);
+            return value;
+        } else {
+            alignas(T) unsigned char buffer[sizeof(T)];
+            std::memcpy(buffer, in, size);
+            return *std::launder(reinterpret_cast<T*>(buffer));
+        }
+    }
+};
+
+// std::string: prefijo de longitud seguido de una capacidad fija, para que el
+// tamaño del bloque se conozca en tiempo de compilación
+template <>
+struct MPointerCodec<std::string> {
+    static constexpr std::size_t max_length = 256;
+    static constexpr std::size_t size = sizeof(std::uint32_t) + max_length;
+
+    static void encode(const std::string& value, char* out) {
+        if (value.size() > max_length) {
+            throw std::runtime_error("String too long for MPointer: " + std::to_string(value.size()) +
+                                     " > " + std::to_string(max_length));
+        }
+        std::uint32_t length = static_cast<std::uint32_t>(value.size());
+        std::memcpy(out, &length, sizeof(length));
+        std::memcpy(out + sizeof(length), value.data(), length);
+        std::memset(out + sizeof(length) + length, 0, max_length - length);
+    }
+
+    static std::string decode(const char* in) {
+        std::uint32_t length;
+        std::memcpy(&length, in, sizeof(length));
+        if (length > max_length) {
+            throw std::runtime_error("Invalid string length in memory block");
+        }
+        return std::string(in + sizeof(length), length);
+    }
+};
+
+// std::array de elementos no triviales: cada elemento usa su propio codec
+template <typename T, std::size_t N>
+struct MPointerCodec<std::array<T, N>, std::enable_if_t<!is_mpointer_memcpy_v<std::array<T, N>>>> {
+    static constexpr std::size_t size = MPointerCodec<T>::size * N;
+
+    static void encode(const std::array<T, N>& value, char* out) {
+        for (std::size_t i = 0; i < N; ++i) {
+            MPointerCodec<T>::encode(value[i], out + i * MPointerCodec<T>::size);
+        }
+    }
+
+    static std::array<T, N> decode(const char* in) {
+        std::array<T, N> value;
+        for (std::size_t i = 0; i < N; ++i) {
+            value[i] = MPointerCodec<T>::decode(in + i * MPointerCodec<T>::size);
+        }
+        return value;
+    }
+};
+
+#endif // MPOINTER_CODEC_H